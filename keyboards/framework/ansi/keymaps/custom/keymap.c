@@ -308,11 +308,45 @@ void toggle_led(void) {
 }
 
 
+// LED frame buffers
+//  - Colors are rendered into a frame buffer, then flushed to the matrix.
+//  - On a layer change the outgoing and incoming frames are each rendered once
+//    and cross-faded with an 8-bit weight (0 = outgoing, 255 = incoming).
+static const uint16_t LAYER_FADE_TIME = 150u;  // 0 disables cross-fades
+static const layer_state_t LAYER_FADE_MASK = ((layer_state_t)1 << _FN)
+                                           | ((layer_state_t)1 << _FN_LOCK)
+                                           | ((layer_state_t)1 << _FM)
+                                           | ((layer_state_t)1 << _SUPER);
+
+static RGB     led_frames[2][LED_COUNT];
+static uint8_t led_frame_in = 0;  // current (incoming) frame, !led_frame_in is outgoing
+
+static inline uint8_t blend_u8(const uint8_t out, const uint8_t in, const uint8_t w) {
+    return (uint8_t)(((uint16_t)out * (uint16_t)(256u - w) + (uint16_t)in * w) >> 8);
+}
+
+void blend_led_frames(RGB* dst, const uint8_t w) {
+    const RGB* out = led_frames[!led_frame_in];
+    const RGB* in  = led_frames[led_frame_in];
+    for (uint8_t idx = 0; idx < LED_COUNT; ++idx) {
+        dst[idx].r = blend_u8(out[idx].r, in[idx].r, w);
+        dst[idx].g = blend_u8(out[idx].g, in[idx].g, w);
+        dst[idx].b = blend_u8(out[idx].b, in[idx].b, w);
+    }
+}
+
+void flush_led_frame(const RGB* frame) {
+    for (uint8_t idx = 0; idx < LED_COUNT; ++idx) {
+        rgb_matrix_set_color(idx, frame[idx].r, frame[idx].g, frame[idx].b);
+    }
+}
+
+
 // LED color control
 #define COLOR(hsv) (HSV){hsv}
 
 void set_led_color_rgb(const uint8_t idx, const RGB rgb) {
-    rgb_matrix_set_color(idx, rgb.r, rgb.g, rgb.b);
+    led_frames[led_frame_in][idx] = rgb;
 }
 
 void set_led_color_hsv(const uint8_t idx, HSV hsv) {
@@ -513,8 +547,8 @@ HSV get_caps_lock_indicator_hsv(const hsv_style_st* hsv_style) {
 }
 
 
-// LED -> HSV assignment
-bool rgb_matrix_indicators_user(void) {
+// LED -> HSV assignment (rendered into led_frames[led_frame_in])
+void render_led_frame(void) {
     static const HSV COLOR_OFF =         COLOR(HSV_OFF);
     static const HSV COLOR_FUCHSIA =     COLOR(HSV_FUCHSIA);
     static const HSV COLOR_VIOLET =      COLOR(HSV_VIOLET);
@@ -581,10 +615,6 @@ bool rgb_matrix_indicators_user(void) {
     static const led_style_st LED_STYLE_SHIFT = led_style(&STYLE_SOLID_GREEN, NULL, NULL, NULL, NULL);
 
 
-    update_blink();
-    update_fade();
-
-
     set_array_color_hsv(LED_ALPHABET, get_led_style_hsv(&LED_STYLE_ALPHABET));
     set_array_color_hsv(LED_NUMBERS,  get_led_style_hsv(&LED_STYLE_NUMBERS));
     set_array_color_hsv(LED_SYMBOLS,  get_led_style_hsv(&LED_STYLE_SYMBOLS));
@@ -630,6 +660,43 @@ bool rgb_matrix_indicators_user(void) {
         
         set_array_color_hsv(LED_SPACE,   process_hsv_style(&STYLE_SOLID_RED));
     }
+}
+
+bool rgb_matrix_indicators_user(void) {
+    static layer_state_t fade_layer_state = 0;
+    static bool          fade_active = false;
+    static uint16_t      fade_timer = 0;
+
+    update_blink();
+    update_fade();
+
+    const layer_state_t layer_state_masked = layer_state & LAYER_FADE_MASK;
+    if (layer_state_masked != fade_layer_state && LAYER_FADE_TIME) {
+        fade_layer_state = layer_state_masked;
+        if (fade_active) {
+            // interrupted fade: what is on the matrix now becomes the outgoing frame
+            blend_led_frames(led_frames[!led_frame_in], (uint8_t)MIN(255u, (uint32_t)timer_elapsed(fade_timer) * 256u / LAYER_FADE_TIME));
+        } else {
+            led_frame_in = !led_frame_in;
+        }
+        render_led_frame();
+        fade_active = true;
+        fade_timer = timer_read();
+    }
+
+    if (fade_active) {
+        const uint16_t elapsed = timer_elapsed(fade_timer);
+        if (elapsed < LAYER_FADE_TIME) {
+            static RGB blended[LED_COUNT];
+            blend_led_frames(blended, (uint8_t)((uint32_t)elapsed * 256u / LAYER_FADE_TIME));
+            flush_led_frame(blended);
+            return true;
+        }
+        fade_active = false;
+    }
+
+    render_led_frame();
+    flush_led_frame(led_frames[led_frame_in]);
 
     return true;
 }